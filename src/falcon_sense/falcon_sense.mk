@@ -8,7 +8,7 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := falcon_sense
-SOURCES  := falcon_sense.C
+SOURCES  := falcon_sense.C outputFalcon.C
 
 SRC_INCDIRS  := .. ../AS_UTL ../stores ../overlapInCore/libedlib libfalcon
 
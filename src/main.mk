@@ -53,6 +53,7 @@ SOURCES      := AS_global.C \
                 stores/gkStoreEncode.C \
                 \
                 stores/ovOverlap.C \
+                stores/ovOverlapSort.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
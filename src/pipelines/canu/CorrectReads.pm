@@ -200,6 +200,7 @@ sub buildCorrectionLayouts_direct ($) {
         $cmd .= "  -T ../$asm.corStore 1 \\\n";
         $cmd .= "  -o ./correction_inputs/ \\\n";
         $cmd .= "  -p " . $jobs . " \\\n";
+        $cmd .= "  -binary \\\n";
         $cmd .= "> ./correction_inputs.err 2>&1";
 
         if (runCommand($path, $cmd)) {
@@ -304,6 +305,8 @@ sub buildCorrectionLayouts_direct ($) {
         print F "  --min_ovl_len " . getGlobal("minOverlapLength") . "\\\n";
         print F "  --min_cov " . getGlobal("corMinCoverage") . " \\\n";
         print F "  --n_core " . getGlobal("corThreads") . " \\\n";
+        print F "  --binary \\\n";
+        print F "  --template_threads " . getGlobal("corThreads") . " \\\n";
         print F "  < ./correction_inputs/\$jobid \\\n";
         print F "  > ./correction_outputs/\$jobid.fasta.WORKING \\\n";
         print F " 2> ./correction_outputs/\$jobid.err \\\n";
@@ -334,7 +337,7 @@ sub buildCorrectionLayouts_direct ($) {
 
 
 
-#  For falcon_sense, using a pipe and no intermediate files
+#  For falcon_sense, with layouts and consensus computed in one process, and no intermediate files.
 #
 sub buildCorrectionLayouts_piped ($) {
     my $asm  = shift @_;
@@ -440,11 +443,6 @@ sub buildCorrectionLayouts_piped ($) {
     my $minidt   = 1 - $erate;
 
     print F "\n";
-    print F "if [ \"x\$BASH\" != \"x\" ] ; then\n";   #  Needs doublequotes, else shell doesn't expand $BASH
-    print F "  set -o pipefail\n";
-    print F "fi\n";
-    print F "\n";
-    print F "( \\\n";
     print F "\$bin/generateCorrectionLayouts -b \$bgn -e \$end \\\n";
     print F "  -rl ./$asm.readsToCorrect \\\n"                     if (-e "$path/$asm.readsToCorrect");
     print F "  -G \$gkpStore \\\n";
@@ -454,28 +452,18 @@ sub buildCorrectionLayouts_piped ($) {
     print F "  -E " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
     print F "  -C $maxCov \\\n"                                    if (defined($maxCov));
     print F "  -legacy \\\n"                                       if (defined(getGlobal("corLegacyFilter")));
-    print F "  -F \\\n";
-    print F "&& \\\n";
-    print F "  touch ./correction_outputs/\$jobid.dump.success \\\n";
-    print F ") \\\n";
-    print F "| \\\n";
-    print F "\$bin/falcon_sense \\\n";
-    print F "  --min_idt $minidt \\\n";
-    print F "  --min_len " . getGlobal("minReadLength") . "\\\n";
-    print F "  --max_read_len " . 2 * getMaxReadLengthInStore($base, $asm) . " \\\n";
-    print F "  --min_ovl_len " . getGlobal("minOverlapLength") . "\\\n";
-    print F "  --min_cov " . getGlobal("corMinCoverage") . " \\\n";
-    print F "  --n_core " . getGlobal("corThreads") . " \\\n";
+    print F "  -Fc \\\n";
+    print F "  -min_idt $minidt \\\n";
+    print F "  -min_len " . getGlobal("minReadLength") . " \\\n";
+    print F "  -max_read_len " . 2 * getMaxReadLengthInStore($base, $asm) . " \\\n";
+    print F "  -min_ovl_len " . getGlobal("minOverlapLength") . " \\\n";
+    print F "  -min_cov " . getGlobal("corMinCoverage") . " \\\n";
+    print F "  -threads " . getGlobal("corThreads") . " \\\n";
     print F "  > ./correction_outputs/\$jobid.fasta.WORKING \\\n";
     print F " 2> ./correction_outputs/\$jobid.err \\\n";
     print F "&& \\\n";
     print F "mv ./correction_outputs/\$jobid.fasta.WORKING ./correction_outputs/\$jobid.fasta \\\n";
     print F "\n";
-    print F "if [ ! -e \"./correction_outputs/\$jobid.dump.success\" ] ; then\n";
-    print F "  echo Read layout generation failed.\n";
-    print F "  mv ./correction_outputs/\$jobid.fasta ./correction_outputs/\$jobid.fasta.INCOMPLETE\n";
-    print F "fi\n";
-    print F "\n";
 
     if (defined($stageDir)) {
         print F "rm -rf $stageDir/$asm.gkpStore\n";   #  Prevent accidents of 'rm -rf /' if stageDir = "/".
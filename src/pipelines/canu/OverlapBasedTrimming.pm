@@ -54,6 +54,19 @@ use canu::HTML;
 use canu::Grid_Cloud;
 
 
+#  trimReads, splitReads and the final dump run inside this process.  On a grid, that's a job that
+#  asked for one thread; otherwise, use the whole machine, or as much of it as maxThreads allows.
+
+sub trimmingThreads () {
+    my $thr = (getGlobal("useGrid") eq "1") ? 1 : getNumberOfCPUs();
+
+    $thr = getGlobal("maxThreads")   if ((defined(getGlobal("maxThreads"))) && (getGlobal("maxThreads") < $thr));
+
+    return($thr);
+}
+
+
+
 sub trimReads ($) {
     my $asm    = shift @_;
     my $bin    = getBinDirectory();
@@ -79,6 +92,7 @@ sub trimReads ($) {
     #$cmd .= "  -Cm ./$asm.max.clear \\\n"          if (-e "./$asm.max.clear");
     $cmd .= "  -ol " . getGlobal("trimReadsOverlap") . " \\\n";
     $cmd .= "  -oc " . getGlobal("trimReadsCoverage") . " \\\n";
+    $cmd .= "  -threads " . trimmingThreads() . " \\\n";
     $cmd .= "  -o  ./$asm.1.trimReads \\\n";
     $cmd .= ">     ./$asm.1.trimReads.err 2>&1";
 
@@ -151,6 +165,7 @@ sub splitReads ($) {
     $cmd .= "  -Co ./$asm.2.splitReads.clear \\\n";
     $cmd .= "  -e  $erate \\\n";
     $cmd .= "  -minlength " . getGlobal("minReadLength") . " \\\n";
+    $cmd .= "  -threads " . trimmingThreads() . " \\\n";
     $cmd .= "  -o  ./$asm.2.splitReads \\\n";
     $cmd .= ">     ./$asm.2.splitReads.err 2>&1";
 
@@ -219,6 +234,7 @@ sub dumpReads ($) {
     $cmd  = "$bin/gatekeeperDumpFASTQ -fasta -nolibname \\\n";
     $cmd .= "  -G ./$asm.gkpStore \\\n";
     $cmd .= "  -c $inp \\\n";
+    $cmd .= "  -threads " . trimmingThreads() . " \\\n";
     $cmd .= "  -o ../$asm.trimmedReads.gz \\\n";     #  Adds .fasta
     $cmd .= ">    ../$asm.trimmedReads.err 2>&1";
 
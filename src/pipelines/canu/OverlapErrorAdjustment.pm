@@ -384,6 +384,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     my $maxMem   = getGlobal("oeaMemory") * 1024 * 1024 * 1024;
     my $maxReads = getGlobal("oeaBatchSize");
     my $maxBases = getGlobal("oeaBatchLength");
+    my $threads  = getGlobal("oeaThreads");
 
     print STDERR "\n";
     print STDERR "Configure OEA for ", getGlobal("oeaMemory"), "gb memory with batches of at most ", ($maxReads > 0) ? $maxReads : "(unlimited)", " reads and ", ($maxBases > 0) ? $maxBases : "(unlimited)", " bases.\n";
@@ -413,9 +414,9 @@ sub overlapErrorAdjustmentConfigure ($) {
         my $memAdj1   = (8   * $corrSize) * 0.33;    #  Overestimate of the size of the indel adjustments needed (total size includes mismatches)
         my $memReads  = (32  * $reads);              #  Read data in the batch
         my $memOlaps  = (32  * $olaps);              #  Loaded overlaps
-        my $memSeq    = (4   * 2097152);             #  two char arrays of 2*maxReadLen
-        my $memAdj2   = (16  * 2097152);             #  two Adjust_t arrays of maxReadLen
-        my $memWA     = (32  * 1048576);             #  Work area (16mb) and edit array (16mb)
+        my $memSeq    = (4   * 2097152) * $threads;  #  two char arrays of 2*maxReadLen, per thread
+        my $memAdj2   = (16  * 2097152) * $threads;  #  two Adjust_t arrays of maxReadLen, per thread
+        my $memWA     = (32  * 1048576) * $threads;  #  Work area (16mb) and edit array (16mb), per thread
         my $memMisc   = (256 * 1048576);             #  Work area (16mb) and edit array (16mb) and (192mb) slop
 
         my $memory = $memBases + $memAdj1 + $memReads + $memOlaps + $memSeq + $memAdj2 + $memWA + $memMisc;
@@ -513,6 +514,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "  -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -c ./red.red \\\n";
     print F "  -o ./\$jobid.oea.WORKING \\\n";
+    print F "  -t " . getGlobal("oeaThreads") . " \\\n";
     print F "&& \\\n";
     print F "mv ./\$jobid.oea.WORKING ./\$jobid.oea\n";
     print F "\n";
@@ -89,6 +89,7 @@ sub createOverlapStoreSequential ($$$) {
     #  to submit canu to grids using the maximum of 4gb and this memory limit.
 
     my $memSize = getGlobal("ovsMemory");
+    my $threads = getGlobal("ovsThreads");
 
     #  The parallel store build will unlimit 'max user processes'.  The sequential method usually
     #  runs out of open file handles first (meaning it has never run out of processes yet).
@@ -97,6 +98,7 @@ sub createOverlapStoreSequential ($$$) {
     $cmd .= " -O ./$asm.ovlStore.BUILDING \\\n";
     $cmd .= " -G ./$asm.gkpStore \\\n";
     $cmd .= " -M $memSize \\\n";
+    $cmd .= " -t $threads \\\n";
     $cmd .= " -L ./1-overlapper/ovljob.files \\\n";
     $cmd .= " > ./$asm.ovlStore.err 2>&1";
 
@@ -316,6 +318,7 @@ sub overlapStoreConfigure ($$$) {
         print F "\$bin/ovStoreSorter \\\n";
         print F "  -deletelate \\\n";  #  Choices -deleteearly -deletelate or nothing
         print F "  -M $memLimit \\\n";
+        print F "  -t " . getGlobal("ovsThreads") . " \\\n";
         print F "  -O . \\\n";
         print F "  -G ../$asm.gkpStore \\\n";
         print F "  -F $numSlices \\\n";